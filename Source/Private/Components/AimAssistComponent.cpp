@@ -8,6 +8,7 @@
 #include "Camera/PlayerCameraManager.h"
 #include "Types/AimAssistData.h"
 #include "GameFramework/Pawn.h"
+#include "Components/SphereComponent.h"
 
 // Sets default values for this component's properties
 UAimAssistComponent::UAimAssistComponent()
@@ -34,6 +35,10 @@ UAimAssistComponent::UAimAssistComponent()
 	MagnetismRadius = 75.0f;
 	CurrentAimMagnetism = 0.0f;
 
+	bUseProximitySensor = false;
+	SensorObjectTypes = {ECC_Pawn};
+	SensorRadiusPadding = 0.0f;
+
 	bShowDebug = false;
 }
 
@@ -63,9 +68,31 @@ void UAimAssistComponent::BeginPlay()
 		const auto& InputDeviceSubsystem = GEngine->GetEngineSubsystem<UInputDeviceSubsystem>();
 		check(InputDeviceSubsystem);
 		InputDeviceSubsystem->OnInputHardwareDeviceChanged.AddDynamic(this, &UAimAssistComponent::OnHardwareDeviceChanged);
+
+		// Sensor is created lazily, IsLocalController is not reliable yet on clients
+		if (bUseProximitySensor)
+			PlayerController->OnPossessedPawnChanged.AddDynamic(this, &UAimAssistComponent::OnPossessedPawnChanged);
 	}
 }
 
+// Called when the game ends or the component is removed
+void UAimAssistComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (IsValid(ProximitySensor))
+	{
+		ProximitySensor->OnComponentBeginOverlap.RemoveAll(this);
+		ProximitySensor->OnComponentEndOverlap.RemoveAll(this);
+		ProximitySensor->DestroyComponent();
+	}
+	ProximitySensor = nullptr;
+	NearbyTargets.Empty();
+
+	if (IsValid(PlayerController))
+		PlayerController->OnPossessedPawnChanged.RemoveAll(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 // Called every frame
 void UAimAssistComponent::TickComponent(float DeltaTime, ELevelTick TickType,
                                         FActorComponentTickFunction* ThisTickFunction)
@@ -76,17 +103,20 @@ void UAimAssistComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 	if (!IsValid(PlayerController) || !PlayerController->IsLocalController() || !IsValid(PlayerCameraManager))
 		return;
 
-	// Clear the previous best target data
-	BestTargetData = FAimTargetData{};
-	// Reset the friction and magnetism values
-	CurrentAimFriction = 0.0f;
-	CurrentAimMagnetism = 0.0f;
+	// Keep the sensor in sync in case the sweep reach was changed directly
+	UpdateSensorRadius();
+
+	// Clear the previous best target data, friction and magnetism values
+	ResetAimAssistValues();
 
 	// If Aim assist should only work with game pad? Check if the game pad is in use
 	if (bUseOnlyOnGamepad)
 	{
 		if (IsUsingGamepad() == false)
+		{
+			PublishSnapshot();
 			return;
+		}
 	}
 
 	// Get list of valid targets
@@ -120,16 +150,27 @@ void UAimAssistComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 			}
 		}
 	}
+
+	// Make this frame's results visible to other threads
+	PublishSnapshot();
 }
 
 void UAimAssistComponent::EnableAimAssist(bool bEnabled)
 {
-	SetComponentTickEnabled(bEnabled);
 	bAimAssistEnabled = bEnabled;
 
-	// Reset the values
-	CurrentAimFriction = 0.0f;
-	CurrentAimMagnetism = 0.0f;
+	if (bEnabled)
+	{
+		CreateProximitySensor();
+		UpdateSensorRadius();
+	}
+
+	// Reset the values, unless going to sleep already published the reset
+	if (!UpdateTickState())
+	{
+		ResetAimAssistValues();
+		PublishSnapshot();
+	}
 }
 
 bool UAimAssistComponent::IsUsingGamepad() const
@@ -389,3 +430,187 @@ void UAimAssistComponent::ApplyMagnetism(const float DeltaTime, const FVector& T
 	// Apply the new rotation
 	PlayerController->SetControlRotation(NewRotation);
 }
+
+bool UAimAssistComponent::HasNearbyTargets() const
+{
+	// Controlled pawn can be a target class too, it may also have been possessed after it entered the sensor
+	const APawn* ControlledPawn = IsValid(PlayerController) ? PlayerController->GetPawn() : nullptr;
+
+	for (const auto& Target : NearbyTargets)
+	{
+		if (Target.IsValid() && Target.Get() != ControlledPawn)
+			return true;
+	}
+	return false;
+}
+
+void UAimAssistComponent::CreateProximitySensor()
+{
+	// Only local controllers need a sensor, remote controllers on a listen server never run the sweep
+	if (!bUseProximitySensor || IsValid(ProximitySensor) || !IsValid(PlayerController) ||
+		!PlayerController->IsLocalController() || !IsValid(PlayerCameraManager))
+		return;
+
+	// Sphere around the camera large enough to contain the whole sweep
+	ProximitySensor = NewObject<USphereComponent>(PlayerCameraManager, NAME_None);
+	ProximitySensor->InitSphereRadius(GetSensorRadius());
+	ProximitySensor->SetCanEverAffectNavigation(false);
+	ProximitySensor->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	ProximitySensor->SetCollisionResponseToAllChannels(ECR_Ignore);
+	for (const auto& ObjectType : SensorObjectTypes)
+	{
+		ProximitySensor->SetCollisionResponseToChannel(ObjectType, ECR_Overlap);
+	}
+	ProximitySensor->SetGenerateOverlapEvents(true);
+
+	ProximitySensor->OnComponentBeginOverlap.AddDynamic(this, &UAimAssistComponent::OnSensorBeginOverlap);
+	ProximitySensor->OnComponentEndOverlap.AddDynamic(this, &UAimAssistComponent::OnSensorEndOverlap);
+
+	// Camera manager follows the camera POV every frame
+	ProximitySensor->SetupAttachment(PlayerCameraManager->GetRootComponent());
+	ProximitySensor->RegisterComponent();
+
+	// Pick up targets that were already in range when the sensor was created
+	ProximitySensor->UpdateOverlaps();
+	CollectNearbyTargets();
+}
+
+float UAimAssistComponent::GetSensorRadius() const
+{
+	return OverlapRange + OverlapBoxHalfSize.Size() + SensorRadiusPadding;
+}
+
+void UAimAssistComponent::UpdateSensorRadius()
+{
+	if (!IsValid(ProximitySensor))
+		return;
+
+	const float SensorRadius = GetSensorRadius();
+	if (FMath::IsNearlyEqual(ProximitySensor->GetUnscaledSphereRadius(), SensorRadius))
+		return;
+
+	// Resize and rebuild the target set, targets inside the new sweep reach must wake the component up
+	ProximitySensor->SetSphereRadius(SensorRadius, true);
+	CollectNearbyTargets();
+}
+
+void UAimAssistComponent::CollectNearbyTargets()
+{
+	NearbyTargets.Empty();
+
+	TArray<AActor*> OverlappingActors;
+	ProximitySensor->GetOverlappingActors(OverlappingActors);
+	for (AActor* Actor : OverlappingActors)
+	{
+		if (Actor->GetClass()->ImplementsInterface(UAimTargetInterface::StaticClass()))
+			NearbyTargets.Add(Actor);
+	}
+}
+
+void UAimAssistComponent::SetOverlapRange(float NewOverlapRange)
+{
+	OverlapRange = FMath::Max(NewOverlapRange, 25.0f);
+	UpdateSensorRadius();
+	UpdateTickState();
+}
+
+void UAimAssistComponent::SetOverlapBoxHalfSize(const FVector& NewOverlapBoxHalfSize)
+{
+	OverlapBoxHalfSize = NewOverlapBoxHalfSize;
+	UpdateSensorRadius();
+	UpdateTickState();
+}
+
+bool UAimAssistComponent::UpdateTickState()
+{
+	// Drop targets that were destroyed without an end overlap
+	for (auto It = NearbyTargets.CreateIterator(); It; ++It)
+	{
+		if (!It->IsValid())
+			It.RemoveCurrent();
+	}
+
+	// Without a sensor the component always ticks while enabled
+	const bool bHasSensor = bUseProximitySensor && IsValid(ProximitySensor);
+	const bool bShouldTick = bAimAssistEnabled && (!bHasSensor || HasNearbyTargets());
+
+	if (IsComponentTickEnabled() == bShouldTick)
+		return false;
+
+	SetComponentTickEnabled(bShouldTick);
+
+	// Going to sleep, do not leave stale values behind
+	if (!bShouldTick)
+	{
+		ResetAimAssistValues();
+		PublishSnapshot();
+		return true;
+	}
+	return false;
+}
+
+void UAimAssistComponent::ResetAimAssistValues()
+{
+	BestTargetData = FAimTargetData{};
+	CurrentAimFriction = 0.0f;
+	CurrentAimMagnetism = 0.0f;
+}
+
+void UAimAssistComponent::PublishSnapshot()
+{
+	FAimAssistSnapshot Snapshot;
+	Snapshot.FrameNumber = static_cast<int64>(GFrameCounter);
+	Snapshot.WorldTimeSeconds = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	Snapshot.PlatformTimeSeconds = FPlatformTime::Seconds();
+	Snapshot.bHasTarget = IsValid(BestTargetData.Component);
+	Snapshot.Component = BestTargetData.Component;
+	Snapshot.SocketName = BestTargetData.SocketName;
+	Snapshot.SocketLocation = BestTargetData.SocketLocation;
+	Snapshot.AimFriction = CurrentAimFriction;
+	Snapshot.AimFrictionScale = GetCurrentAimFriction();
+	Snapshot.AimMagnetism = CurrentAimMagnetism;
+
+	SnapshotBuffer.Publish(Snapshot);
+}
+
+FAimAssistSnapshot UAimAssistComponent::GetLatestSnapshot() const
+{
+	return SnapshotBuffer.Read();
+}
+
+UPrimitiveComponent* UAimAssistComponent::GetLatestSnapshotComponent() const
+{
+	check(IsInGameThread());
+	return SnapshotBuffer.Read().Component.Get();
+}
+
+void UAimAssistComponent::OnSensorBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+                                               UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep,
+                                               const FHitResult& SweepResult)
+{
+	// Team filter is left to GetValidTargets, teams can be assigned after the actor enters the sensor
+	if (!IsValid(OtherActor) || !OtherActor->GetClass()->ImplementsInterface(UAimTargetInterface::StaticClass()))
+		return;
+
+	NearbyTargets.Add(OtherActor);
+	UpdateTickState();
+}
+
+void UAimAssistComponent::OnSensorEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+                                             UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	// Actor may still overlap the sensor with another one of its components
+	if (IsValid(OtherActor) && IsValid(ProximitySensor) && ProximitySensor->IsOverlappingActor(OtherActor))
+		return;
+
+	NearbyTargets.Remove(OtherActor);
+	UpdateTickState();
+}
+
+void UAimAssistComponent::OnPossessedPawnChanged(APawn* OldPawn, APawn* NewPawn)
+{
+	if (bAimAssistEnabled)
+		CreateProximitySensor();
+
+	UpdateTickState();
+}
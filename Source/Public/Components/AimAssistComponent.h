@@ -6,11 +6,14 @@
 #include "Components/ActorComponent.h"
 #include "GenericTeamAgentInterface.h"
 #include "GameFramework/InputDeviceSubsystem.h"
+#include "Types/AimAssistSnapshot.h"
 #include "AimAssistComponent.generated.h"
 
+class APawn;
 class APlayerController;
 class APlayerCameraManager;
 class USceneComponent;
+class USphereComponent;
 struct FAimAssistTarget;
 
 /**
@@ -48,6 +51,9 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
+	// Called when the game ends or the component is removed
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:	
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -97,7 +103,65 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AimAssist|Magnetism")
 	void ApplyMagnetism(const float DeltaTime, const FVector& TargetLocation, const FVector& TargetDirection) const;
 
+	//** Sets the sweep range, use this at runtime so the proximity sensor follows */
+	UFUNCTION(BlueprintCallable, Category = "AimAssist")
+	void SetOverlapRange(float NewOverlapRange);
+
+	//** Sets the sweep box half size, use this at runtime so the proximity sensor follows */
+	UFUNCTION(BlueprintCallable, Category = "AimAssist")
+	void SetOverlapBoxHalfSize(const FVector& NewOverlapBoxHalfSize);
+
+	//** Returns true if the proximity sensor currently has potential targets in range */
+	UFUNCTION(BlueprintPure, Category = "AimAssist|Sensor")
+	bool HasNearbyTargets() const;
+
+	/**
+	* @return returns the results of the last completed aim assist frame, safe to call from any thread
+	*/
+	UFUNCTION(BlueprintPure, Category = "AimAssist", meta = (BlueprintThreadSafe))
+	FAimAssistSnapshot GetLatestSnapshot() const;
+
+	/**
+	* @return returns the target component of the last completed aim assist frame, game thread only
+	*/
+	UFUNCTION(BlueprintPure, Category = "AimAssist")
+	UPrimitiveComponent* GetLatestSnapshotComponent() const;
+
 protected:
+	//** Creates the proximity sensor and attaches it to the camera manager, only for local controllers */
+	void CreateProximitySensor();
+
+	//** Sensor radius that contains the whole sweep */
+	float GetSensorRadius() const;
+
+	//** Resizes the sensor if the sweep reach changed and rebuilds the nearby targets */
+	void UpdateSensorRadius();
+
+	//** Rebuilds the nearby targets from the actors overlapping the sensor */
+	void CollectNearbyTargets();
+
+	//** Enables tick only when aim assist is enabled and, in sensor mode, targets are nearby. Returns true if it published a reset */
+	bool UpdateTickState();
+
+	//** Clears the best target, friction and magnetism */
+	void ResetAimAssistValues();
+
+	//** Publishes the current best target, friction and magnetism for readers on other threads */
+	void PublishSnapshot();
+
+	UFUNCTION()
+	void OnSensorBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp,
+	                          int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	UFUNCTION()
+	void OnSensorEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp,
+	                        int32 OtherBodyIndex);
+
+	//** Re-evaluates the sensor targets when the controlled pawn changes */
+	UFUNCTION()
+	void OnPossessedPawnChanged(APawn* OldPawn, APawn* NewPawn);
+
+
 	UPROPERTY(BlueprintReadWrite, Category = "AimAssist")
 	TObjectPtr<APlayerController> PlayerController;
 
@@ -174,6 +238,28 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "AimAssist|Magnetism")
 	float CurrentAimMagnetism;
 	
+	//** Sensor section */
+	// Only tick while the proximity sensor reports potential targets in range, sleep otherwise
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AimAssist|Sensor")
+	bool bUseProximitySensor;
+
+	// Object types that wake the component up, keep this list short since the sensor overlaps them every frame
+	UPROPERTY(EditDefaultsOnly, Category = "AimAssist|Sensor", meta = (EditCondition = "bUseProximitySensor"))
+	TArray<TEnumAsByte<ECollisionChannel>> SensorObjectTypes;
+
+	// Extra radius added on top of the sweep reach, gives the component a head start before targets enter the sweep
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AimAssist|Sensor", meta = (EditCondition = "bUseProximitySensor", ClampMin = "0.0"))
+	float SensorRadiusPadding;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AimAssist|Sensor")
+	TObjectPtr<USphereComponent> ProximitySensor;
+
+	// Actors implementing the target interface that currently overlap the sensor, team and pawn filters are applied later
+	TSet<TWeakObjectPtr<AActor>> NearbyTargets;
+
+	// Double buffered results of the last completed frame
+	FAimAssistSnapshotBuffer SnapshotBuffer;
+
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "AimAssist|Debug")
 	bool bShowDebug;
 };
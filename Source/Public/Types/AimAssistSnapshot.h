@@ -0,0 +1,129 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+#include <atomic>
+#include <type_traits>
+#include "AimAssistSnapshot.generated.h"
+
+/**
+ * Results of a single aim assist frame, published by the component at the end of its tick.
+ * Safe to copy on any thread. The component pointer is not exposed to Blueprint, since thread-safe
+ * Blueprint functions would resolve it off the game thread, use UAimAssistComponent::GetLatestSnapshotComponent.
+ */
+USTRUCT(BlueprintType)
+struct AIMASSIST_API FAimAssistSnapshot
+{
+    GENERATED_BODY()
+
+    // Engine frame counter when the snapshot was published
+    UPROPERTY(BlueprintReadOnly, Category = "AimAssistSnapshot")
+    int64 FrameNumber = 0;
+
+    // World time in seconds when the snapshot was published
+    UPROPERTY(BlueprintReadOnly, Category = "AimAssistSnapshot")
+    double WorldTimeSeconds = 0.0;
+
+    // Platform time in seconds when the snapshot was published, comparable across threads
+    UPROPERTY(BlueprintReadOnly, Category = "AimAssistSnapshot")
+    double PlatformTimeSeconds = 0.0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AimAssistSnapshot")
+    bool bHasTarget = false;
+
+    // Only resolve on the game thread
+    UPROPERTY()
+    TWeakObjectPtr<UPrimitiveComponent> Component;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AimAssistSnapshot")
+    FName SocketName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AimAssistSnapshot")
+    FVector SocketLocation = FVector::ZeroVector;
+
+    // Raw friction factor from the friction curve
+    UPROPERTY(BlueprintReadOnly, Category = "AimAssistSnapshot")
+    float AimFriction = 0.0f;
+
+    // Friction as input scale (1 - FrictionFactor), same as GetCurrentAimFriction
+    UPROPERTY(BlueprintReadOnly, Category = "AimAssistSnapshot")
+    float AimFrictionScale = 1.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AimAssistSnapshot")
+    float AimMagnetism = 0.0f;
+};
+
+/**
+ * Lock-free double buffer for aim assist snapshots.
+ * Single writer (game thread), any number of readers on any thread.
+ * Each slot carries a sequence number that is odd while being written, readers retry
+ * if the slot changed under them so they always get the last complete frame.
+ * This is a seqlock: the payload copy itself is not atomic and may race with a write,
+ * torn copies are detected by the sequence check and discarded. That requires the payload
+ * to be trivially copyable, so copying a torn value is harmless.
+ */
+class AIMASSIST_API FAimAssistSnapshotBuffer
+{
+    static_assert(std::is_trivially_copyable_v<FAimAssistSnapshot>, "Seqlock payload must be trivially copyable");
+
+public:
+    FAimAssistSnapshotBuffer() = default;
+
+    FAimAssistSnapshotBuffer(const FAimAssistSnapshotBuffer&) = delete;
+    FAimAssistSnapshotBuffer& operator=(const FAimAssistSnapshotBuffer&) = delete;
+
+    // Writes into the back slot and flips it to the front, must only be called from one thread
+    void Publish(const FAimAssistSnapshot& Snapshot)
+    {
+        const uint32 BackIndex = 1 - FrontIndex.load(std::memory_order_relaxed);
+        FSlot& Slot = Slots[BackIndex];
+
+        // Odd sequence marks the slot as being written
+        const uint32 Sequence = Slot.Sequence.load(std::memory_order_relaxed);
+        Slot.Sequence.store(Sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        Slot.Snapshot = Snapshot;
+
+        Slot.Sequence.store(Sequence + 2, std::memory_order_release);
+        FrontIndex.store(BackIndex, std::memory_order_release);
+    }
+
+    // Returns a copy of the last completely published snapshot, safe on any thread
+    FAimAssistSnapshot Read() const
+    {
+        FAimAssistSnapshot Result;
+        for (;;)
+        {
+            const FSlot& Slot = Slots[FrontIndex.load(std::memory_order_acquire)];
+
+            const uint32 SequenceBefore = Slot.Sequence.load(std::memory_order_acquire);
+            if (SequenceBefore & 1)
+            {
+                // Writer lapped us and is rewriting this slot, let it finish
+                FPlatformProcess::YieldThread();
+                continue;
+            }
+
+            Result = Slot.Snapshot;
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (Slot.Sequence.load(std::memory_order_relaxed) == SequenceBefore)
+                return Result;
+
+            FPlatformProcess::YieldThread();
+        }
+    }
+
+private:
+    struct FSlot
+    {
+        std::atomic<uint32> Sequence{0};
+        FAimAssistSnapshot Snapshot;
+    };
+
+    FSlot Slots[2];
+    std::atomic<uint32> FrontIndex{0};
+};